@@ -0,0 +1,102 @@
+#!/bin/bash
+# Checks GKOCG and GKOIR on a decomposed case against PCG. Runs the icoFoam
+# cavity tutorial on two processors with each solver and compares the
+# residuals and iterations of the pressure solves, see
+# compare_solver_logs.py.
+set -e
+
+case_dir=${1:-$HOME/decomposed_check}
+script_dir=$(cd $(dirname $0) && pwd)
+
+write_fv_solution() {
+    # $1 entries of the pressure solver
+    cat > system/fvSolution <<EOF
+FoamFile
+{
+    version     2.0;
+    format      ascii;
+    class       dictionary;
+    object      fvSolution;
+}
+
+solvers
+{
+    p
+    {
+        $1
+        tolerance       1e-08;
+        relTol          0;
+    }
+
+    pFinal
+    {
+        \$p;
+    }
+
+    U
+    {
+        solver          smoothSolver;
+        smoother        symGaussSeidel;
+        tolerance       1e-05;
+        relTol          0;
+    }
+}
+
+PISO
+{
+    nCorrectors     2;
+    nNonOrthCorrectors 0;
+    pRefCell        0;
+    pRefValue       0;
+}
+EOF
+}
+
+write_decompose_par_dict() {
+    cat > system/decomposeParDict <<EOF
+FoamFile
+{
+    version     2.0;
+    format      ascii;
+    class       dictionary;
+    object      decomposeParDict;
+}
+
+numberOfSubdomains 2;
+
+method          simple;
+
+simpleCoeffs
+{
+    n               (2 1 1);
+    delta           0.001;
+}
+EOF
+}
+
+# $1 name of the run, $2 entries of the pressure solver
+run_case() {
+    rm -rf $case_dir
+    cp -r $FOAM_TUTORIALS/incompressible/icoFoam/cavity/cavity $case_dir
+    cd $case_dir
+    foamDictionary system/controlDict -entry libs -set '("libOGL.so")'
+    foamDictionary system/controlDict -entry endTime -set 0.025
+    write_fv_solution "$2"
+    write_decompose_par_dict
+    blockMesh > log.blockMesh
+    decomposePar > log.decomposePar
+    mpirun -np 2 icoFoam -parallel > log.icoFoam
+    cp log.icoFoam $case_dir.$1.log
+    cd - > /dev/null
+}
+
+run_case PCG "solver PCG; preconditioner none;"
+run_case GKOCG "solver GKOCG; preconditioner none; executor reference;"
+run_case GKOIR "solver GKOIR; innerSolver CG; executor reference;"
+
+# GKOCG follows PCG, thus the iterations have to match as well, the inner
+# solver of GKOIR is local to every processor
+python3 $script_dir/compare_solver_logs.py --iterations \
+    $case_dir.PCG.log $case_dir.GKOCG.log 1e-08
+python3 $script_dir/compare_solver_logs.py \
+    $case_dir.PCG.log $case_dir.GKOIR.log 1e-08
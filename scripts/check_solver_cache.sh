@@ -0,0 +1,91 @@
+#!/bin/bash
+# Checks that the solver of a field is only reused if the solver controls
+# of the final solve (pFinal) match the controls of p. Runs the icoFoam
+# cavity tutorial with verbose output and counts the generated solvers.
+set -e
+
+case_dir=${1:-$HOME/cache_check}
+
+write_fv_solution() {
+    # $1 entries of pFinal which differ from p
+    cat > system/fvSolution <<EOF
+FoamFile
+{
+    version     2.0;
+    format      ascii;
+    class       dictionary;
+    object      fvSolution;
+}
+
+solvers
+{
+    p
+    {
+        solver          GKOIR;
+        innerSolver     CG;
+        innerReductionFactor 1e-2;
+        preconditioner  none;
+        executor        reference;
+        directAssembly  yes;
+        verbose         yes;
+        tolerance       1e-06;
+        relTol          0.05;
+    }
+
+    pFinal
+    {
+        \$p;
+        relTol          0;
+        $1
+    }
+
+    U
+    {
+        solver          smoothSolver;
+        smoother        symGaussSeidel;
+        tolerance       1e-05;
+        relTol          0;
+    }
+}
+
+PISO
+{
+    nCorrectors     2;
+    nNonOrthCorrectors 0;
+    pRefCell        0;
+    pRefValue       0;
+}
+EOF
+}
+
+# $1 entries of pFinal, $2 expected number of generated solvers or "solves"
+# if a solver has to be generated for every solve
+run_case() {
+    rm -rf $case_dir
+    cp -r $FOAM_TUTORIALS/incompressible/icoFoam/cavity/cavity $case_dir
+    cd $case_dir
+    foamDictionary system/controlDict -entry libs -set '("libOGL.so")'
+    foamDictionary system/controlDict -entry endTime -set 0.025
+    write_fv_solution "$1"
+    blockMesh > log.blockMesh
+    icoFoam > log.icoFoam
+
+    solves=$(grep -c "Solving for p," log.icoFoam)
+    generated=$(grep -c "\[OGL LOG\] p generate_solver" log.icoFoam)
+    expected=$2
+    if [ "$expected" = solves ]; then
+        expected=$solves
+    fi
+    echo "pFinal: '$1' solves: $solves generated solvers: $generated"
+    if [ "$generated" != "$expected" ]; then
+        echo "expected $expected generated solvers"
+        exit 1
+    fi
+}
+
+# only the controls of the stopping criterion differ, the solver is reused
+run_case "" 1
+
+# p and pFinal alternate, thus every solve regenerates the solver
+run_case "innerReductionFactor 1e-1;" solves
+run_case "maxBlockSize 8;" solves
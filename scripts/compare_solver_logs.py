@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""Compares the pressure solves of two solver logs
+
+Usage:
+    compare_solver_logs.py [--iterations] <reference> <log> <tolerance>
+
+The initial residuals of every solve have to match within a relative
+difference of 1e-3 and the final residuals of the log have to be below the
+tolerance. With --iterations the number of iterations may differ by one.
+"""
+import re
+import sys
+
+SOLVE = re.compile(
+    r"Solving for p, Initial residual = (\S+), Final residual = (\S+),"
+    r" No Iterations (\d+)"
+)
+
+
+def read_solves(fn):
+    with open(fn) as fh:
+        return [
+            (float(m.group(1)), float(m.group(2)), int(m.group(3)))
+            for m in SOLVE.finditer(fh.read())
+        ]
+
+
+def relative_difference(res1, res2):
+    return abs(res1 - res2) / max(abs(res1), 1e-300)
+
+
+if __name__ == "__main__":
+
+    args = sys.argv[1:]
+    check_iterations = "--iterations" in args
+    if check_iterations:
+        args.remove("--iterations")
+    reference_fn, fn, tolerance = args[0], args[1], float(args[2])
+
+    reference = read_solves(reference_fn)
+    solves = read_solves(fn)
+    if not reference or len(reference) != len(solves):
+        print(
+            "{} has {} pressure solves, {} has {}".format(
+                reference_fn, len(reference), fn, len(solves)
+            )
+        )
+        sys.exit(1)
+
+    failed = False
+    for i, (ref, solve) in enumerate(zip(reference, solves)):
+        errors = []
+        if relative_difference(ref[0], solve[0]) > 1e-3:
+            errors.append("initial residual")
+        if solve[1] > tolerance:
+            errors.append("final residual")
+        if check_iterations and abs(ref[2] - solve[2]) > 1:
+            errors.append("iterations")
+        print(
+            "solve {}: reference {} {} {} log {} {} {} {}".format(
+                i, *ref, *solve, " ".join(errors)
+            )
+        )
+        failed = failed or bool(errors)
+
+    if failed:
+        sys.exit(1)